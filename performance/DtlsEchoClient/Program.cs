@@ -0,0 +1,181 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Threading;
+using CSharpServer;
+using NDesk.Options;
+
+namespace DtlsEchoClient
+{
+    class EchoClient : DtlsClient
+    {
+        public EchoClient(Service service, SslContext context, string address, int port, int messages) : base(service, context, address, port)
+        {
+            _messages = messages;
+        }
+
+        protected override void OnHandshaked()
+        {
+            for (long i = _messages; i > 0; --i)
+                SendMessage();
+        }
+
+        protected override void OnReceived(UdpAddress address, byte[] buffer, long size)
+        {
+            Program.TimestampStop = DateTime.UtcNow;
+            Interlocked.Add(ref Program.TotalBytes, size);
+            Interlocked.Increment(ref Program.TotalMessages);
+
+            SendMessage();
+        }
+
+        protected override void OnError(int error, string category, string message)
+        {
+            Console.WriteLine($"Client caught an error with code {error} and category '{category}': {message}");
+            Interlocked.Increment(ref Program.TotalErrors);
+        }
+
+        private void SendMessage()
+        {
+            SendAsync(Program.MessageToSend);
+        }
+
+        private long _messages;
+    }
+
+    class Program
+    {
+        public static byte[] MessageToSend;
+        public static DateTime TimestampStart = DateTime.UtcNow;
+        public static DateTime TimestampStop = DateTime.UtcNow;
+        public static long TotalErrors;
+        public static long TotalBytes;
+        public static long TotalMessages;
+
+        static void Main(string[] args)
+        {
+            bool help = false;
+            string address = "127.0.0.1";
+            int port = 4444;
+            int threads = Environment.ProcessorCount;
+            int clients = 100;
+            int messages = 1000;
+            int size = 32;
+            int seconds = 10;
+
+            var options = new OptionSet()
+            {
+                { "h|?|help",   v => help = v != null },
+                { "a|address=", v => address = v },
+                { "p|port=", v => port = int.Parse(v) },
+                { "t|threads=", v => threads = int.Parse(v) },
+                { "c|clients=", v => clients = int.Parse(v) },
+                { "m|messages=", v => messages = int.Parse(v) },
+                { "s|size=", v => size = int.Parse(v) },
+                { "z|seconds=", v => seconds = int.Parse(v) }
+            };
+
+            try
+            {
+                options.Parse(args);
+            }
+            catch (OptionException e)
+            {
+                Console.Write("Command line error: ");
+                Console.WriteLine(e.Message);
+                Console.WriteLine("Try `--help' to get usage information.");
+                return;
+            }
+
+            if (help)
+            {
+                Console.WriteLine("Usage:");
+                options.WriteOptionDescriptions(Console.Out);
+                return;
+            }
+
+            Console.WriteLine($"Server address: {address}");
+            Console.WriteLine($"Server port: {port}");
+            Console.WriteLine($"Working threads: {threads}");
+            Console.WriteLine($"Working clients: {clients}");
+            Console.WriteLine($"Working messages: {messages}");
+            Console.WriteLine($"Message size: {size}");
+            Console.WriteLine($"Seconds to benchmarking: {seconds}");
+
+            Console.WriteLine();
+
+            // Prepare a message to send
+            MessageToSend = new byte[size];
+
+            // Create a new service
+            var service = new Service(threads);
+
+            // Start the service
+            Console.Write("Service starting...");
+            service.Start();
+            Console.WriteLine("Done!");
+
+            // Create and prepare a new DTLS client context
+            var context = new SslContext(SslMethod.DTLS_Client);
+            context.SetDefaultVerifyPaths();
+            context.SetRootCerts();
+            context.SetVerifyMode(SslVerifyMode.VerifyPeer | SslVerifyMode.VerifyFailIfNoPeerCert);
+            context.LoadVerifyFile("ca.pem");
+
+            // Create echo clients
+            var echoClients = new List<EchoClient>();
+            for (int i = 0; i < clients; ++i)
+            {
+                var client = new EchoClient(service, context, address, port, messages);
+                echoClients.Add(client);
+            }
+
+            TimestampStart = DateTime.UtcNow;
+
+            // Connect clients
+            Console.Write("Clients connecting...");
+            foreach (var client in echoClients)
+                client.ConnectAsync();
+            Console.WriteLine("Done!");
+            foreach (var client in echoClients)
+                while (!client.IsHandshaked)
+                    Thread.Yield();
+            Console.WriteLine("All clients handshaked!");
+
+            // Wait for benchmarking
+            Console.Write("Benchmarking...");
+            Thread.Sleep(seconds * 1000);
+            Console.WriteLine("Done!");
+
+            // Disconnect clients
+            Console.Write("Clients disconnecting...");
+            foreach (var client in echoClients)
+                client.DisconnectAsync();
+            Console.WriteLine("Done!");
+            foreach (var client in echoClients)
+                while (client.IsConnected)
+                    Thread.Yield();
+            Console.WriteLine("All clients disconnected!");
+
+            // Stop the service
+            Console.Write("Service stopping...");
+            service.Stop();
+            Console.WriteLine("Done!");
+
+            Console.WriteLine();
+
+            Console.WriteLine($"Errors: {TotalErrors}");
+
+            Console.WriteLine();
+
+            Console.WriteLine($"Total time: {Service.GenerateTimePeriod((TimestampStop - TimestampStart).TotalMilliseconds)}");
+            Console.WriteLine($"Total data: {Service.GenerateDataSize(TotalBytes)}");
+            Console.WriteLine($"Total messages: {TotalMessages}");
+            Console.WriteLine($"Data throughput: {Service.GenerateDataSize((long)(TotalBytes / (TimestampStop - TimestampStart).TotalSeconds))}/s");
+            if (TotalMessages > 0)
+            {
+                Console.WriteLine($"Message latency: {Service.GenerateTimePeriod((TimestampStop - TimestampStart).TotalMilliseconds / TotalMessages)}");
+                Console.WriteLine($"Message throughput: {(long)(TotalMessages / (TimestampStop - TimestampStart).TotalSeconds)} msg/s");
+            }
+        }
+    }
+}
@@ -0,0 +1,120 @@
+﻿using System;
+using CSharpServer;
+using NDesk.Options;
+
+namespace DtlsEchoServer
+{
+    class EchoServer : DtlsServer
+    {
+        public EchoServer(Service service, SslContext context, int port, InternetProtocol protocol) : base(service, context, port, protocol) {}
+
+        protected override void OnReceived(UdpAddress address, byte[] buffer, long size)
+        {
+            // Resend the message back to the client
+            SendAsync(address, buffer, 0, size);
+        }
+
+        protected override void OnError(int error, string category, string message)
+        {
+            Console.WriteLine($"Server caught an error with code {error} and category '{category}': {message}");
+        }
+    }
+
+    class Program
+    {
+        static void Main(string[] args)
+        {
+            bool help = false;
+            int port = 4444;
+            int threads = Environment.ProcessorCount;
+
+            var options = new OptionSet()
+            {
+                { "h|?|help",   v => help = v != null },
+                { "p|port=", v => port = int.Parse(v) },
+                { "t|threads=", v => threads = int.Parse(v) }
+            };
+
+            try
+            {
+                options.Parse(args);
+            }
+            catch (OptionException e)
+            {
+                Console.Write("Command line error: ");
+                Console.WriteLine(e.Message);
+                Console.WriteLine("Try `--help' to get usage information.");
+                return;
+            }
+
+            if (help)
+            {
+                Console.WriteLine("Usage:");
+                options.WriteOptionDescriptions(Console.Out);
+                return;
+            }
+
+            Console.WriteLine($"Server port: {port}");
+            Console.WriteLine($"Working threads: {threads}");
+
+            Console.WriteLine();
+
+            // Create a new service
+            var service = new Service(threads);
+
+            // Start the service
+            Console.Write("Service starting...");
+            service.Start();
+            Console.WriteLine("Done!");
+
+            // Create and prepare a new DTLS server context
+            var context = new SslContext(SslMethod.DTLS_Server);
+            context.SetPassword("qwerty");
+            context.UseCertificateChainFile("server.pem");
+            context.UsePrivateKeyFile("server.pem", SslFileFormat.PEM);
+            context.UseTmpDHFile("dh4096.pem");
+
+            // Create a new echo server
+            var server = new EchoServer(service, context, port, InternetProtocol.IPv4);
+            server.SetupReuseAddress(true);
+            server.SetupReusePort(true);
+
+            // Start the server
+            Console.Write("Server starting...");
+            server.Start();
+            Console.WriteLine("Done!");
+
+            Console.WriteLine("Press Enter to stop the server or '!' to restart the server...");
+
+            // Perform text input
+            for (;;)
+            {
+                string line = Console.ReadLine();
+                if (line == string.Empty)
+                    break;
+
+                // Restart the server
+                if (line == "!")
+                {
+                    Console.Write("Server restarting...");
+                    server.Restart();
+                    Console.WriteLine("Done!");
+                }
+            }
+
+            Console.WriteLine($"Handshakes completed: {server.HandshakesCompleted}");
+            Console.WriteLine($"Handshakes failed: {server.HandshakesFailed}");
+            Console.WriteLine($"Handshakes rejected: {server.HandshakesRejected}");
+
+            // Stop the server
+            Console.Write("Server stopping...");
+            server.Stop();
+            Console.WriteLine("Done!");
+
+            // Stop the service
+            Console.Write("Service stopping...");
+            service.Stop();
+            Console.WriteLine("Done!");
+        }
+    }
+}
@@ -0,0 +1,251 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Threading;
+using CSharpServer;
+using NDesk.Options;
+
+namespace SslCipherBenchmark
+{
+    class EchoSession : SslSession
+    {
+        public EchoSession(SslServer server) : base(server) {}
+
+        protected override void OnReceived(byte[] buffer, long size)
+        {
+            // Resend the message back to the client
+            SendAsync(buffer, 0, size);
+        }
+
+        protected override void OnError(int error, string category, string message)
+        {
+            Console.WriteLine($"Session caught an error with code {error} and category '{category}': {message}");
+        }
+    }
+
+    class EchoServer : SslServer
+    {
+        public EchoServer(Service service, SslContext context, string address, int port) : base(service, context, address, port) {}
+
+        protected override SslSession CreateSession() { return new EchoSession(this); }
+
+        protected override void OnError(int error, string category, string message)
+        {
+            Console.WriteLine($"Server caught an error with code {error} and category '{category}': {message}");
+        }
+    }
+
+    class EchoClient : SslClient
+    {
+        public EchoClient(Service service, SslContext context, string address, int port, int messages) : base(service, context, address, port)
+        {
+            _messages = messages;
+        }
+
+        protected override void OnHandshaked()
+        {
+            for (long i = _messages; i > 0; --i)
+                SendMessage();
+        }
+
+        protected override void OnReceived(byte[] buffer, long size)
+        {
+            _received += size;
+            while (_received >= Program.MessageToSend.Length)
+            {
+                SendMessage();
+                _received -= Program.MessageToSend.Length;
+            }
+
+            Interlocked.Add(ref Program.TotalBytes, size);
+        }
+
+        protected override void OnError(int error, string category, string message)
+        {
+            Console.WriteLine($"Client caught an error with code {error} and category '{category}': {message}");
+            Interlocked.Increment(ref Program.TotalErrors);
+        }
+
+        private void SendMessage()
+        {
+            SendAsync(Program.MessageToSend);
+        }
+
+        private long _received;
+        private long _messages;
+    }
+
+    class Program
+    {
+        public static byte[] MessageToSend;
+        public static long TotalErrors;
+        public static long TotalBytes;
+
+        // Cipher suites of TLS 1.3 and cipher lists of TLS 1.2
+        static readonly string[] DefaultSuites =
+        {
+            "TLS_AES_128_GCM_SHA256",
+            "TLS_AES_256_GCM_SHA384",
+            "TLS_CHACHA20_POLY1305_SHA256",
+            "ECDHE-RSA-AES128-GCM-SHA256",
+            "ECDHE-RSA-AES256-GCM-SHA384",
+            "ECDHE-RSA-CHACHA20-POLY1305"
+        };
+
+        static void Main(string[] args)
+        {
+            bool help = false;
+            string address = "127.0.0.1";
+            int port = 2222;
+            int threads = Environment.ProcessorCount;
+            int clients = 100;
+            int messages = 1000;
+            int size = 32;
+            int seconds = 10;
+            string suites = string.Join(",", DefaultSuites);
+
+            var options = new OptionSet()
+            {
+                { "h|?|help",   v => help = v != null },
+                { "a|address=", v => address = v },
+                { "p|port=", v => port = int.Parse(v) },
+                { "t|threads=", v => threads = int.Parse(v) },
+                { "c|clients=", v => clients = int.Parse(v) },
+                { "m|messages=", v => messages = int.Parse(v) },
+                { "s|size=", v => size = int.Parse(v) },
+                { "z|seconds=", v => seconds = int.Parse(v) },
+                { "x|suites=", v => suites = v }
+            };
+
+            try
+            {
+                options.Parse(args);
+            }
+            catch (OptionException e)
+            {
+                Console.Write("Command line error: ");
+                Console.WriteLine(e.Message);
+                Console.WriteLine("Try `--help' to get usage information.");
+                return;
+            }
+
+            if (help)
+            {
+                Console.WriteLine("Usage:");
+                options.WriteOptionDescriptions(Console.Out);
+                return;
+            }
+
+            Console.WriteLine($"Server address: {address}");
+            Console.WriteLine($"Server port: {port}");
+            Console.WriteLine($"Working threads: {threads}");
+            Console.WriteLine($"Working clients: {clients}");
+            Console.WriteLine($"Working messages: {messages}");
+            Console.WriteLine($"Message size: {size}");
+            Console.WriteLine($"Seconds to benchmarking: {seconds}");
+            Console.WriteLine($"Hardware AES: {SslContext.IsHardwareAes}");
+
+            Console.WriteLine();
+
+            // Prepare a message to send
+            MessageToSend = new byte[size];
+
+            // Create a new service
+            var service = new Service(threads);
+
+            // Start the service
+            Console.Write("Service starting...");
+            service.Start();
+            Console.WriteLine("Done!");
+
+            var results = new List<Tuple<string, long, long>>();
+            foreach (var suite in suites.Split(new[] { ',' }, StringSplitOptions.RemoveEmptyEntries))
+            {
+                Console.WriteLine();
+                Console.WriteLine($"Cipher suite: {suite}");
+
+                TotalErrors = 0;
+                TotalBytes = 0;
+
+                // Create and prepare a new SSL server context restricted to the benchmarked suite
+                var serverContext = new SslContext(SslMethod.TLS);
+                serverContext.SetPassword("qwerty");
+                serverContext.UseCertificateChainFile("server.pem");
+                serverContext.UsePrivateKeyFile("server.pem", SslFileFormat.PEM);
+                serverContext.UseTmpDHFile("dh4096.pem");
+                if (suite.StartsWith("TLS_"))
+                {
+                    serverContext.SetMinMaxProtocolVersion(SslProtocolVersion.TLSV13, SslProtocolVersion.TLSV13);
+                    serverContext.SetCipherSuites(suite);
+                }
+                else
+                {
+                    serverContext.SetMinMaxProtocolVersion(SslProtocolVersion.TLSV12, SslProtocolVersion.TLSV12);
+                    serverContext.SetCipherList(suite);
+                }
+
+                // Create and prepare a new SSL client context
+                var clientContext = new SslContext(SslMethod.TLS);
+                clientContext.SetDefaultVerifyPaths();
+                clientContext.SetRootCerts();
+                clientContext.SetVerifyMode(SslVerifyMode.VerifyPeer | SslVerifyMode.VerifyFailIfNoPeerCert);
+                clientContext.LoadVerifyFile("ca.pem");
+
+                // Start a new echo server
+                var server = new EchoServer(service, serverContext, address, port);
+                server.SetupReuseAddress(true);
+                server.SetupReusePort(true);
+                server.Start();
+
+                // Create echo clients
+                var echoClients = new List<EchoClient>();
+                for (int i = 0; i < clients; ++i)
+                    echoClients.Add(new EchoClient(service, clientContext, address, port, messages));
+
+                // Connect clients
+                foreach (var client in echoClients)
+                    client.ConnectAsync();
+                foreach (var client in echoClients)
+                    while (!client.IsHandshaked && (Interlocked.Read(ref TotalErrors) == 0))
+                        Thread.Yield();
+
+                // Measure only the data exchange after all handshakes
+                long startBytes = Interlocked.Read(ref TotalBytes);
+                var timestampStart = DateTime.UtcNow;
+                Thread.Sleep(seconds * 1000);
+                var timestampStop = DateTime.UtcNow;
+                long totalBytes = Interlocked.Read(ref TotalBytes) - startBytes;
+
+                // Disconnect clients
+                foreach (var client in echoClients)
+                    client.DisconnectAsync();
+                foreach (var client in echoClients)
+                    while (client.IsConnected)
+                        Thread.Yield();
+
+                // Stop the echo server
+                server.Stop();
+
+                long throughput = (long)(totalBytes / (timestampStop - timestampStart).TotalSeconds);
+                results.Add(Tuple.Create(suite, throughput, Interlocked.Read(ref TotalErrors)));
+
+                Console.WriteLine($"Errors: {TotalErrors}");
+                Console.WriteLine($"Total data: {Service.GenerateDataSize(totalBytes)}");
+                Console.WriteLine($"Data throughput: {Service.GenerateDataSize(throughput)}/s");
+                Console.WriteLine($"Message throughput: {throughput / size} msg/s");
+            }
+
+            Console.WriteLine();
+
+            // Stop the service
+            Console.Write("Service stopping...");
+            service.Stop();
+            Console.WriteLine("Done!");
+
+            Console.WriteLine();
+
+            Console.WriteLine("Throughput per cipher suite:");
+            foreach (var result in results)
+                Console.WriteLine($"{result.Item1,-32} {Service.GenerateDataSize(result.Item2),12}/s {result.Item2 / size,12} msg/s {result.Item3,6} errors");
+        }
+    }
+}
@@ -14,7 +14,7 @@ namespace UdpEchoServer
             ReceiveAsync();
         }
 
-        protected override void OnReceived(UdpEndpoint endpoint, byte[] buffer, long size)
+        protected override void OnReceived(UdpAddress address, byte[] buffer, long size)
         {
             // Continue receive datagrams
             if (size == 0)
@@ -24,10 +24,10 @@ namespace UdpEchoServer
             }
 
             // Echo the message back to the sender
-            SendAsync(endpoint, buffer, 0, size);
+            SendAsync(address, buffer, 0, size);
         }
 
-        protected override void OnSent(UdpEndpoint endpoint, long sent)
+        protected override void OnSent(UdpAddress address, long sent)
         {
             // Continue receive datagrams
             ReceiveAsync();
@@ -46,12 +46,14 @@ namespace UdpEchoServer
             bool help = false;
             int port = 3333;
             int threads = Environment.ProcessorCount;
+            int receives = 0;
 
             var options = new OptionSet()
             {
                 { "h|?|help",   v => help = v != null },
                 { "p|port=", v => port = int.Parse(v) },
-                { "t|threads=", v => threads = int.Parse(v) }
+                { "t|threads=", v => threads = int.Parse(v) },
+                { "r|receives=", v => receives = int.Parse(v) }
             };
 
             try
@@ -75,6 +77,7 @@ namespace UdpEchoServer
 
             Console.WriteLine($"Server port: {port}");
             Console.WriteLine($"Working threads: {threads}");
+            Console.WriteLine($"Concurrent receives: {receives}");
 
             Console.WriteLine();
 
@@ -90,6 +93,7 @@ namespace UdpEchoServer
             var server = new EchoServer(service, port, InternetProtocol.IPv4);
             server.SetupReuseAddress(true);
             server.SetupReusePort(true);
+            server.SetupConcurrentReceives(receives);
 
             // Start the server
             Console.Write("Server starting...");
@@ -119,6 +123,10 @@ namespace UdpEchoServer
             server.Stop();
             Console.WriteLine("Done!");
 
+            // Show receive statistics of service threads
+            foreach (var statistics in server.GetReceiveThreadStatistics())
+                Console.WriteLine(statistics);
+
             // Stop the service
             Console.Write("Service stopping...");
             service.Stop();
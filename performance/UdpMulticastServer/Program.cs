@@ -26,6 +26,10 @@ namespace UdpMulticastServer
             int threads = Environment.ProcessorCount;
             int messagesRate = 1000000;
             int messageSize = 32;
+            int batchSize = 1;
+            bool segmentation = false;
+            int pacing = 0;
+            int burst = 64;
 
             var options = new OptionSet()
             {
@@ -34,7 +38,11 @@ namespace UdpMulticastServer
                 { "p|port=", v => port = int.Parse(v) },
                 { "t|threads=", v => threads = int.Parse(v) },
                 { "m|messages=", v => messagesRate = int.Parse(v) },
-                { "s|size=", v => messageSize = int.Parse(v) }
+                { "s|size=", v => messageSize = int.Parse(v) },
+                { "b|batch=", v => batchSize = int.Parse(v) },
+                { "g|segmentation", v => segmentation = v != null },
+                { "c|pacing=", v => pacing = int.Parse(v) },
+                { "u|burst=", v => burst = int.Parse(v) }
             };
 
             try
@@ -61,6 +69,10 @@ namespace UdpMulticastServer
             Console.WriteLine($"Working threads: {threads}");
             Console.WriteLine($"Messages rate: {messagesRate}");
             Console.WriteLine($"Message size: {messageSize}");
+            Console.WriteLine($"Batch size: {batchSize}");
+            Console.WriteLine($"Segmentation: {segmentation}");
+            Console.WriteLine($"Pacing rate: {pacing}");
+            Console.WriteLine($"Pacing burst: {burst}");
 
             Console.WriteLine();
 
@@ -76,6 +88,8 @@ namespace UdpMulticastServer
             var server = new MulticastServer(service, 0, InternetProtocol.IPv4);
             server.SetupReuseAddress(true);
             server.SetupReusePort(true);
+            server.SetupSegmentation(segmentation);
+            server.SetupPacing(pacing, burst);
 
             // Start the server
             Console.Write("Server starting...");
@@ -84,17 +98,28 @@ namespace UdpMulticastServer
 
             // Start the multicasting thread
             bool multicasting = true;
+            long multicasted = 0;
+            var timestamp = DateTime.UtcNow;
             var multicaster = Task.Factory.StartNew(() =>
             {
-                // Prepare message to multicast
-                byte[] message = new byte[messageSize];
+                // Prepare messages batch to multicast
+                int batch = Math.Max(batchSize, 1);
+                byte[] message = new byte[messageSize * batch];
 
                 // Multicasting loop
                 while (multicasting)
                 {
                     var start = DateTime.UtcNow;
-                    for (int i = 0; i < messagesRate; ++i)
-                        server.Multicast(message);
+                    for (int i = 0; i < messagesRate; i += batch)
+                    {
+                        if (pacing > 0)
+                            server.MulticastAsync(message, 0, messageSize);
+                        else if (batch > 1)
+                            server.MulticastBatch(message, 0, messageSize, Math.Min(batch, messagesRate - i));
+                        else
+                            server.Multicast(message);
+                    }
+                    multicasted += messagesRate;
                     var end = DateTime.UtcNow;
 
                     // Sleep for remaining time or yield
@@ -128,6 +153,28 @@ namespace UdpMulticastServer
             multicasting = false;
             multicaster.Wait();
 
+            var elapsed = DateTime.UtcNow - timestamp;
+
+            Console.WriteLine();
+
+            Console.WriteLine($"Total time: {Service.GenerateTimePeriod(elapsed.TotalMilliseconds)}");
+            Console.WriteLine($"Total messages: {multicasted}");
+            Console.WriteLine($"Segmented sends: {server.SegmentedSends}");
+            Console.WriteLine($"Segmentation supported: {server.IsSegmentationSupported}");
+            if (pacing > 0)
+            {
+                Console.WriteLine($"Paced messages: {server.PacedDatagrams}");
+                Console.WriteLine($"Pacing dropped: {server.PacingDropped}");
+                Console.WriteLine($"Pacing late: {server.PacingLate}");
+                Console.WriteLine($"Pacing max lateness: {server.PacingMaxLateness.TotalMilliseconds:F3} ms");
+                Console.WriteLine($"Pacing average delay: {server.PacingAverageDelay.TotalMilliseconds:F3} ms");
+                Console.WriteLine($"Pacing queue max depth: {server.PacingQueueMaxDepth}");
+            }
+            Console.WriteLine();
+            Console.WriteLine($"Messages throughput: {(long)(multicasted / elapsed.TotalSeconds)} msg/s");
+
+            Console.WriteLine();
+
             // Stop the server
             Console.Write("Server stopping...");
             server.Stop();